@@ -0,0 +1,84 @@
+// Memory accounting overhead (libtlmem): reading a 20000-item list into a
+// fresh state without accounting, with accounting and no limit, and with a
+// limit it stays under
+
+#include "../src/libtl.h"
+#include "../src/libtlaux.h"
+#include "../src/libtlmem.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+enum { ITEMS = 20000 };
+
+static double now_ms(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+}
+
+// One round on its own allocator, -1 on errors
+static int round_ms(unsigned long limit, const char *src, size_t len,
+                    double *ms) {
+  static tl_state s;
+  tlaux_tc *tc = NULL;
+  if (tlaux_tc_new(&tc))
+    return -1;
+  tl_init_opts opts = {.alloc_vt = &TLAUX_TC_ALLOCATOR_VT,
+                       .alloc = tc,
+                       .stack_size = 256,
+                       .rstack_size = 128,
+                       .mem_limit = limit};
+  tl_obj_ptr obj;
+  size_t n;
+  int ret = -1;
+  if (!tl_init(&s, &opts)) {
+    double start = now_ms();
+    ret = tl_read_raw(&s, src, len, &obj, &n) ? -1 : 0;
+    *ms = now_ms() - start;
+    tl_destroy(&s);
+  }
+  tlaux_tc_free(tc);
+  return ret;
+}
+
+static int run(const char *name, unsigned long limit, const char *src,
+               size_t len, int rounds) {
+  double best = 0, ms;
+  for (int r = 0; r < rounds; r++) {
+    if (round_ms(limit, src, len, &ms)) {
+      fprintf(stderr, "%s: read failed\n", name);
+      return -1;
+    }
+    if (!r || ms < best)
+      best = ms;
+  }
+  printf("%-22s %8.2f ms per read (best of %d)\n", name, best, rounds);
+  return 0;
+}
+
+int main(int argc, char **argv) {
+  int rounds = argc > 1 ? atoi(argv[1]) : 20;
+  if (rounds <= 0)
+    rounds = 1;
+
+  char *src = malloc(1 << 22);
+  size_t len = 0;
+  if (!src)
+    return 1;
+  len += sprintf(src + len, "(");
+  for (int i = 0; i < ITEMS; i++)
+    len += sprintf(src + len, "(item-%d %d %d.25 \"string %d\" [%d %d]) ",
+                   i % 50, i * 37, i, i, i, i + 1);
+  len += sprintf(src + len, ")");
+
+  // warm up the allocator and the caches
+  run("warm-up", 0, src, len, rounds / 4 + 1);
+  int ret = run("no accounting", 0, src, len, rounds) ||
+            run("accounting, unlimited", TL_MEM_UNLIMITED, src, len,
+                rounds) ||
+            run("accounting, 1 GiB", 1ul << 30, src, len, rounds);
+  free(src);
+  return ret ? 1 : 0;
+}
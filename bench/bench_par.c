@@ -0,0 +1,104 @@
+// pmap/preduce scaling: the same map-reduce over a vector with 1 to N pool
+// workers (N = the online CPUs, or the first arg)
+
+#include "../src/libtl.h"
+#include "../src/libtlaux.h"
+#include "../src/libtlpool.h"
+#include "../src/libtlstd.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+enum { ITEMS = 20000, REPS = 5 };
+
+static double now_ms(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+}
+
+static int eval(tl_state *s, const char *str, tl_obj_ptr *ret) {
+  tl_obj_ptr obj;
+  size_t len;
+  return tl_read_raw(s, str, strlen(str), &obj, &len) ||
+                 tl_eval_raw(s, obj, ret)
+             ? -1
+             : 0;
+}
+
+// Run the map-reduce REPS times with 'workers' workers, '*ms' = the best time
+static int run(tl_state *parent, tl_init_opts *opts, unsigned int workers,
+               double *ms, tl_obj_ptr *res) {
+  tl_pool_opts po = {.threads = workers, .state_opts = *opts, .parent = parent};
+  tl_pool *pool = NULL;
+  tl_state c = {0};
+  if (tl_pool_new(&po, &pool))
+    return -1;
+  if (tl_clone(parent, &c, opts)) {
+    tl_pool_free(pool);
+    return -1;
+  }
+  c.pool = pool;
+
+  int ret = 0;
+  *ms = 0;
+  for (int i = 0; i < REPS && !ret; i++) {
+    double start = now_ms();
+    ret = eval(&c, "(preduce + 0 (pmap work v))", res);
+    double t = now_ms() - start;
+    if (!*ms || t < *ms)
+      *ms = t;
+  }
+
+  tl_pool_free(pool);
+  tl_destroy(&c);
+  return ret;
+}
+
+int main(int argc, char **argv) {
+  long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+  unsigned int max = argc > 1 ? (unsigned int)atoi(argv[1]) : cpus;
+  if (max == 0)
+    max = 1;
+
+  tl_init_opts opts = {
+      .alloc_vt = &TLAUX_C_ALLOCATOR_VT,
+      .stack_size = 256,
+      .rstack_size = 256,
+  };
+  static tl_state p;
+  tl_obj_ptr res;
+  char buf[64];
+  if (tl_init(&p, &opts) || tlstd_load(&p, NULL, NULL) ||
+      eval(&p,
+           "(define work (lambda (x) (+ (* x x) (* x 2) (* x 3) (* x 4) "
+           "(* x 5) (* x 6) (* x 7) (* x 8))))",
+           &res) ||
+      eval(&p, "(define v (vector))", &res))
+    return 1;
+  for (int i = 0; i < ITEMS; i++) {
+    snprintf(buf, sizeof(buf), "(vector-push! v %d)", i);
+    if (eval(&p, buf, &res))
+      return 1;
+  }
+
+  printf("%d items, best of %d, %ld online CPUs\n", ITEMS, REPS, cpus);
+  double base = 0;
+  for (unsigned int w = 1; w <= max; w++) {
+    double ms;
+    if (run(&p, &opts, w, &ms, &res)) {
+      fprintf(stderr, "bench_par: the run with %u workers failed\n", w);
+      return 1;
+    }
+    if (w == 1)
+      base = ms;
+    printf("%3u workers %9.2f ms  x%.2f  (sum %lld)\n", w, ms, base / ms,
+           (long long)res.intg);
+  }
+
+  tl_destroy(&p);
+  return 0;
+}
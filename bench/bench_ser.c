@@ -0,0 +1,91 @@
+// Binary serialization (libtlser) against text: printing and tl_read_raw of
+// a 20000-item mixed list
+
+#include "../src/libtl.h"
+#include "../src/libtlaux.h"
+#include "../src/libtlser.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+enum { ITEMS = 20000, REPS = 10 };
+
+static double now_ms(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+}
+
+int main(void) {
+  static tl_state s;
+  tlaux_tc *tc = NULL;
+  if (tlaux_tc_new(&tc))
+    return 1;
+  tl_init_opts opts = {.alloc_vt = &TLAUX_TC_ALLOCATOR_VT,
+                       .alloc = tc,
+                       .stack_size = 256,
+                       .rstack_size = 256};
+  if (tl_init(&s, &opts))
+    return 1;
+
+  char *src = malloc(1 << 22);
+  size_t len = 0, n;
+  if (!src)
+    return 1;
+  len += sprintf(src + len, "(");
+  for (int i = 0; i < ITEMS; i++)
+    len += sprintf(src + len, "(item-%d math.pi %d %d.25 \"string %d\") ",
+                   i % 50, i * 37, i, i);
+  len += sprintf(src + len, ")");
+
+  tl_obj_ptr obj, back;
+  if (tl_read_raw(&s, src, len, &obj, &n))
+    return 1;
+
+  double print = 0, read = 0, enc = 0, dec = 0, start;
+  size_t bin_len = 0;
+  for (int r = 0; r < REPS; r++) {
+    char *txt = NULL;
+    size_t txt_len = 0;
+    start = now_ms();
+    FILE *f = open_memstream(&txt, &txt_len);
+    if (!f)
+      return 1;
+    tlaux_print_obj(obj, 0, f);
+    fclose(f);
+    print += now_ms() - start;
+    free(txt);
+
+    start = now_ms();
+    if (tl_read_raw(&s, src, len, &back, &n))
+      return 1;
+    read += now_ms() - start;
+
+    tl_ser_enc *e = NULL;
+    tl_ser_dec *d = NULL;
+    start = now_ms();
+    if (tl_ser_enc_new(&s, NULL, NULL, &e) || tl_ser_enc_write(e, obj))
+      return 1;
+    const char *data = tl_ser_enc_data(e, &bin_len);
+    enc += now_ms() - start;
+
+    start = now_ms();
+    if (tl_ser_dec_from(&s, data, bin_len, &d) || tl_ser_dec_read(d, &back))
+      return 1;
+    tl_ser_dec_free(d);
+    dec += now_ms() - start;
+    tl_ser_enc_free(e);
+  }
+
+  printf("%d items: text %zu bytes, binary %zu bytes (mean of %d)\n", ITEMS,
+         len, bin_len, REPS);
+  printf("print %6.2f ms  read %6.2f ms\n", print / REPS, read / REPS);
+  printf("enc   %6.2f ms  dec  %6.2f ms  round trip x%.1f faster\n",
+         enc / REPS, dec / REPS, (print + read) / (enc + dec));
+
+  free(src);
+  tl_destroy(&s);
+  tlaux_tc_free(tc);
+  return 0;
+}
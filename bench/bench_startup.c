@@ -0,0 +1,75 @@
+// Startup time: tl_init with the std library loaded eagerly (tlstd_load) or
+// lazily (tlstd_load_lazy, a module is loaded on the first use of its names)
+
+#include "../src/libtl.h"
+#include "../src/libtlaux.h"
+#include "../src/libtlstd.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+typedef enum bench_mode { bmEager, bmLazy, bmLazyUse } bench_mode;
+
+static double now_ms(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+}
+
+static int eval(tl_state *s, const char *str) {
+  tl_obj_ptr obj, ret;
+  size_t len;
+  return tl_read_raw(s, str, strlen(str), &obj, &len) ||
+                 tl_eval_raw(s, obj, &ret)
+             ? -1
+             : 0;
+}
+
+// One startup (and teardown), -1 on errors
+static int startup(bench_mode mode) {
+  tl_state s = {0};
+  tl_init_opts opts = {
+      .alloc_vt = &TLAUX_C_ALLOCATOR_VT,
+      .stack_size = 256,
+      .rstack_size = 128,
+      .envr_size = 16384,
+  };
+
+  if (tl_init(&s, &opts))
+    return -1;
+  int ret = mode == bmEager ? tlstd_load(&s, NULL, NULL)
+                            : tlstd_load_lazy(&s, NULL);
+  // the first use loads one module
+  if (!ret && mode == bmLazyUse)
+    ret = eval(&s, "(math.+ 1 2)");
+  return tl_destroy(&s) || ret ? -1 : 0;
+}
+
+static int run(const char *name, bench_mode mode, int iters) {
+  double start = now_ms();
+  for (int i = 0; i < iters; i++) {
+    if (startup(mode)) {
+      fprintf(stderr, "%s: startup failed\n", name);
+      return -1;
+    }
+  }
+  double ms = now_ms() - start;
+  printf("%-22s %8.2f us per startup\n", name, ms * 1e3 / iters);
+  return 0;
+}
+
+int main(int argc, char **argv) {
+  int iters = argc > 1 ? atoi(argv[1]) : 2000;
+  if (iters <= 0)
+    iters = 1;
+
+  // warm up the allocator and the caches
+  run("warm-up", bmEager, iters / 10 + 1);
+  if (run("eager tlstd_load", bmEager, iters) ||
+      run("lazy tlstd_load_lazy", bmLazy, iters) ||
+      run("lazy + one module use", bmLazyUse, iters))
+    return 1;
+  return 0;
+}
@@ -0,0 +1,16 @@
+#!/usr/bin/env sh
+
+# Build and run every bench/bench_*.c (optimized, without the debug log) with
+# its default args. CC and CFLAGS can be overridden.
+
+cd "$(dirname "$0")/.." || exit 1
+mkdir -p out/bench
+CC=${CC:-gcc}
+CFLAGS=${CFLAGS:--O2 -DTL_DEBUG_LOG=0}
+
+for b in bench/bench_*.c; do
+  name=$(basename "$b" .c)
+  $CC $CFLAGS src/libtl*.c "$b" -pthread -lm -o "out/bench/$name" || exit 1
+  echo "== $name"
+  "out/bench/$name" || exit 1
+done
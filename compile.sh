@@ -3,4 +3,4 @@
 # This is a temporary script (before moving to make)
 
 mkdir -p out
-gcc src/libtl.c src/libtlaux.c src/libtlstd.c src/tli.c src/libtlht.c -fsanitize=address -m32 -o out/tli
+gcc src/libtl.c src/libtlaux.c src/libtlopt.c src/libtlstd.c src/libtlstd_core.c src/libtlstd_math.c src/libtlstd_vec.c src/libtlstd_arr.c src/libtlstd_hmap.c src/libtlstd_table.c src/libtlstd_chan.c src/libtlstd_par.c src/libtlstd_coro.c src/libtlstd_io.c src/libtlstd_ser.c src/libtlnum.c src/libtlbig.c src/libtlvec.c src/libtlarr.c src/libtlhmap.c src/tli.c src/libtlht.c src/libtlimg.c src/libtlpool.c src/libtlchan.c src/libtlcoro.c src/libtlloop.c src/libtlmem.c src/libtlser.c -pthread -fsanitize=address -m32 -o out/tli